@@ -0,0 +1,574 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "quantity.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+namespace units {
+
+  // widened
+
+  // A fixed_point needs an integral type twice as wide as its raw type for multiplication and division.
+  // 64-bit raw types are therefore only available where the compiler provides __int128 (GCC and Clang on
+  // 64-bit targets, but not MSVC).
+  template<std::size_t Size, bool Signed>
+  struct sized_integer {
+    using type = void;
+  };
+
+  template<>
+  struct sized_integer<1, true> {
+    using type = std::int8_t;
+  };
+
+  template<>
+  struct sized_integer<1, false> {
+    using type = std::uint8_t;
+  };
+
+  template<>
+  struct sized_integer<2, true> {
+    using type = std::int16_t;
+  };
+
+  template<>
+  struct sized_integer<2, false> {
+    using type = std::uint16_t;
+  };
+
+  template<>
+  struct sized_integer<4, true> {
+    using type = std::int32_t;
+  };
+
+  template<>
+  struct sized_integer<4, false> {
+    using type = std::uint32_t;
+  };
+
+  template<>
+  struct sized_integer<8, true> {
+    using type = std::int64_t;
+  };
+
+  template<>
+  struct sized_integer<8, false> {
+    using type = std::uint64_t;
+  };
+
+#if defined(__SIZEOF_INT128__)
+  template<>
+  struct sized_integer<16, true> {
+    __extension__ typedef __int128 type;
+  };
+
+  template<>
+  struct sized_integer<16, false> {
+    __extension__ typedef unsigned __int128 type;
+  };
+#endif
+
+  template<typename Int>
+  struct widened : sized_integer<2 * sizeof(Int), std::is_signed_v<Int>> {
+  };
+
+  template<typename Int>
+  using widened_t = typename widened<Int>::type;
+
+  // fixed_point
+
+  template<typename Int, unsigned FracBits>
+  class fixed_point {
+    Int raw_;
+
+    struct raw_tag {
+    };
+    constexpr fixed_point(raw_tag, Int r) : raw_{r} {}
+
+    using wide = widened_t<Int>;
+    static constexpr Int one = static_cast<Int>(Int(1) << FracBits);
+
+    template<typename T>
+    static constexpr Int to_raw(const T& v)
+    {
+      if constexpr (std::is_floating_point_v<T>)
+        return static_cast<Int>(v * static_cast<T>(one));
+      else
+        return static_cast<Int>(static_cast<wide>(static_cast<Int>(v)) * one);
+    }
+
+    template<typename Int2, unsigned FracBits2>
+    static constexpr Int to_raw(const fixed_point<Int2, FracBits2>& v)
+    {
+      using c_rep = std::common_type_t<wide, widened_t<Int2>>;
+      using c_ratio = std::ratio_divide<std::ratio<(intmax_t(1) << FracBits)>, std::ratio<(intmax_t(1) << FracBits2)>>;
+      return static_cast<Int>(scale<c_ratio>(static_cast<c_rep>(v.raw())));
+    }
+
+    // neither fractional nor integral bits nor the sign are lost
+    template<typename Int2, unsigned FracBits2>
+    static constexpr bool is_lossless_conversion()
+    {
+      return FracBits >= FracBits2 && (std::is_signed_v<Int> || !std::is_signed_v<Int2>) &&
+             std::numeric_limits<Int>::digits - FracBits >= std::numeric_limits<Int2>::digits - FracBits2;
+    }
+
+  public:
+    using raw_type = Int;
+    static constexpr unsigned frac_bits = FracBits;
+    static_assert(std::is_integral_v<Int>, "raw type must be an integral type");
+    static_assert(FracBits < std::numeric_limits<Int>::digits, "too many fractional bits for the raw type");
+    static_assert(FracBits < std::numeric_limits<std::intmax_t>::digits, "fractional scale must fit in std::ratio");
+    static_assert(!std::is_void_v<wide>, "raw type must have a wider integral type for multiplication and division");
+
+    fixed_point() = default;
+
+    template<typename T, Requires<std::is_arithmetic_v<T>> = true>
+    constexpr fixed_point(const T& v) : raw_{to_raw(v)}
+    {
+    }
+
+    template<typename Int2, unsigned FracBits2,
+             Requires<is_lossless_conversion<Int2, FracBits2>()> = true>
+    constexpr fixed_point(const fixed_point<Int2, FracBits2>& v) : raw_{to_raw(v)}
+    {
+    }
+
+    template<typename Int2, unsigned FracBits2,
+             Requires<!is_lossless_conversion<Int2, FracBits2>()> = true>
+    constexpr explicit fixed_point(const fixed_point<Int2, FracBits2>& v) : raw_{to_raw(v)}
+    {
+    }
+
+    static constexpr fixed_point from_raw(Int r) { return fixed_point(raw_tag{}, r); }
+
+    constexpr Int raw() const noexcept { return raw_; }
+
+    constexpr explicit operator bool() const noexcept { return raw_ != 0; }
+
+    template<typename T, Requires<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>> = true>
+    constexpr explicit operator T() const
+    {
+      if constexpr (std::is_floating_point_v<T>)
+        return static_cast<T>(raw_) / static_cast<T>(one);
+      else
+        return static_cast<T>(raw_ / one);
+    }
+
+    constexpr fixed_point operator+() const { return *this; }
+    constexpr fixed_point operator-() const { return from_raw(static_cast<Int>(-raw_)); }
+
+    constexpr fixed_point& operator++()
+    {
+      raw_ += one;
+      return *this;
+    }
+    constexpr fixed_point operator++(int)
+    {
+      fixed_point f(*this);
+      ++*this;
+      return f;
+    }
+
+    constexpr fixed_point& operator--()
+    {
+      raw_ -= one;
+      return *this;
+    }
+    constexpr fixed_point operator--(int)
+    {
+      fixed_point f(*this);
+      --*this;
+      return f;
+    }
+
+    constexpr fixed_point& operator+=(const fixed_point& f) { return *this = *this + f; }
+    constexpr fixed_point& operator-=(const fixed_point& f) { return *this = *this - f; }
+    constexpr fixed_point& operator*=(const fixed_point& f) { return *this = *this * f; }
+    constexpr fixed_point& operator/=(const fixed_point& f) { return *this = *this / f; }
+    constexpr fixed_point& operator%=(const fixed_point& f) { return *this = *this % f; }
+
+    friend constexpr fixed_point operator+(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return from_raw(static_cast<Int>(lhs.raw_ + rhs.raw_));
+    }
+
+    friend constexpr fixed_point operator-(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return from_raw(static_cast<Int>(lhs.raw_ - rhs.raw_));
+    }
+
+    // needs a vector N x N -> 2N bit multiply to vectorize (e.g. AVX2 on x86-64 for a 32-bit raw type)
+    friend constexpr fixed_point operator*(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return from_raw(static_cast<Int>(static_cast<wide>(lhs.raw_) * rhs.raw_ / one));
+    }
+
+    friend constexpr fixed_point operator/(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return from_raw(static_cast<Int>(static_cast<wide>(lhs.raw_) * one / rhs.raw_));
+    }
+
+    friend constexpr fixed_point operator%(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return from_raw(static_cast<Int>(lhs.raw_ % rhs.raw_));
+    }
+
+    // scaling by an integer does not touch the fractional bits; a signed raw value is never converted to unsigned
+    template<typename T>
+    using scalar_rep = std::conditional_t<std::is_signed_v<Int>, std::common_type_t<Int, std::make_signed_t<T>>,
+                                          std::common_type_t<Int, T>>;
+
+    template<typename T, Requires<std::is_integral_v<T> && !std::is_same_v<T, bool>> = true>
+    friend constexpr fixed_point operator*(const fixed_point& f, const T& v)
+    {
+      return from_raw(static_cast<Int>(static_cast<scalar_rep<T>>(f.raw_) * static_cast<scalar_rep<T>>(v)));
+    }
+
+    template<typename T, Requires<std::is_integral_v<T> && !std::is_same_v<T, bool>> = true>
+    friend constexpr fixed_point operator*(const T& v, const fixed_point& f)
+    {
+      return f * v;
+    }
+
+    template<typename T, Requires<std::is_integral_v<T> && !std::is_same_v<T, bool>> = true>
+    friend constexpr fixed_point operator/(const fixed_point& f, const T& v)
+    {
+      return from_raw(static_cast<Int>(static_cast<scalar_rep<T>>(f.raw_) / static_cast<scalar_rep<T>>(v)));
+    }
+
+    // mixing with a floating-point value yields the floating-point type, as std::common_type does
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr T operator+(const fixed_point& f, const T& v) { return static_cast<T>(f) + v; }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr T operator+(const T& v, const fixed_point& f) { return v + static_cast<T>(f); }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr T operator-(const fixed_point& f, const T& v) { return static_cast<T>(f) - v; }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr T operator-(const T& v, const fixed_point& f) { return v - static_cast<T>(f); }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr T operator*(const fixed_point& f, const T& v) { return static_cast<T>(f) * v; }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr T operator*(const T& v, const fixed_point& f) { return v * static_cast<T>(f); }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr T operator/(const fixed_point& f, const T& v) { return static_cast<T>(f) / v; }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr T operator/(const T& v, const fixed_point& f) { return v / static_cast<T>(f); }
+
+    friend constexpr bool operator==(const fixed_point& lhs, const fixed_point& rhs) { return lhs.raw_ == rhs.raw_; }
+    friend constexpr bool operator!=(const fixed_point& lhs, const fixed_point& rhs) { return !(lhs == rhs); }
+    friend constexpr bool operator<(const fixed_point& lhs, const fixed_point& rhs) { return lhs.raw_ < rhs.raw_; }
+    friend constexpr bool operator<=(const fixed_point& lhs, const fixed_point& rhs) { return !(rhs < lhs); }
+    friend constexpr bool operator>(const fixed_point& lhs, const fixed_point& rhs) { return rhs < lhs; }
+    friend constexpr bool operator>=(const fixed_point& lhs, const fixed_point& rhs) { return !(lhs < rhs); }
+
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator==(const fixed_point& f, const T& v) { return static_cast<T>(f) == v; }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator==(const T& v, const fixed_point& f) { return f == v; }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator!=(const fixed_point& f, const T& v) { return !(f == v); }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator!=(const T& v, const fixed_point& f) { return !(f == v); }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator<(const fixed_point& f, const T& v) { return static_cast<T>(f) < v; }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator<(const T& v, const fixed_point& f) { return v < static_cast<T>(f); }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator<=(const fixed_point& f, const T& v) { return !(v < f); }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator<=(const T& v, const fixed_point& f) { return !(f < v); }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator>(const fixed_point& f, const T& v) { return v < f; }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator>(const T& v, const fixed_point& f) { return f < v; }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator>=(const fixed_point& f, const T& v) { return !(f < v); }
+    template<typename T, Requires<std::is_floating_point_v<T>> = true>
+    friend constexpr bool operator>=(const T& v, const fixed_point& f) { return !(v < f); }
+  };
+
+  // is_fixed_point
+
+  template<typename T>
+  struct is_fixed_point : std::false_type {
+  };
+
+  template<typename Int, unsigned FracBits>
+  struct is_fixed_point<fixed_point<Int, FracBits>> : std::true_type {
+  };
+
+  template<typename T>
+  inline constexpr bool is_fixed_point_v = is_fixed_point<T>::value;
+
+  // least_integer
+
+  // the smallest integral type with at least Digits value bits that still has a widened type, or void
+  template<int Digits, bool Signed, std::size_t Size = 1>
+  struct least_integer
+      : std::conditional_t<(static_cast<int>(8 * Size) - Signed >= Digits &&
+                            !std::is_void_v<typename sized_integer<2 * Size, Signed>::type>),
+                           sized_integer<Size, Signed>, least_integer<Digits, Signed, 2 * Size>> {
+  };
+
+  template<int Digits, bool Signed>
+  struct least_integer<Digits, Signed, 32> {
+    using type = void;
+  };
+
+  // common_fixed_point
+
+  template<typename Int, unsigned FracBits>
+  struct fixed_point_of {
+    using type = fixed_point<Int, FracBits>;
+  };
+
+  template<unsigned FracBits>
+  struct fixed_point_of<void, FracBits> {
+  };
+
+  template<typename Int, unsigned FracBits>
+  inline constexpr int integral_bits_v = std::numeric_limits<Int>::digits - static_cast<int>(FracBits);
+
+  // the smallest fixed_point holding the larger integral part, the larger fractional part and the sign of either
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           unsigned FracBits = std::max(FracBits1, FracBits2),
+           int Digits = std::max(integral_bits_v<Int1, FracBits1>, integral_bits_v<Int2, FracBits2>) +
+                        static_cast<int>(FracBits)>
+  struct least_common_fixed_point
+      : fixed_point_of<typename least_integer<Digits, std::is_signed_v<Int1> || std::is_signed_v<Int2>>::type,
+                       FracBits> {
+  };
+
+  // a type both operands convert to implicitly; undefined if no integral type is wide enough
+  template<typename FixedPoint1, typename FixedPoint2>
+  struct common_fixed_point;
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2>
+  struct common_fixed_point<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>
+      : std::conditional_t<
+            std::is_convertible_v<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>,
+            fixed_point_of<Int2, FracBits2>,
+            std::conditional_t<std::is_convertible_v<fixed_point<Int2, FracBits2>, fixed_point<Int1, FracBits1>>,
+                               fixed_point_of<Int1, FracBits1>,
+                               least_common_fixed_point<Int1, FracBits1, Int2, FracBits2>>> {
+  };
+
+  template<typename FixedPoint1, typename FixedPoint2>
+  using common_fixed_point_t = typename common_fixed_point<FixedPoint1, FixedPoint2>::type;
+
+  // operations on different fixed_point types are done in their common type
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr CFixedPoint operator+(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return CFixedPoint(lhs) + CFixedPoint(rhs);
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr CFixedPoint operator-(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return CFixedPoint(lhs) - CFixedPoint(rhs);
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr CFixedPoint operator*(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return CFixedPoint(lhs) * CFixedPoint(rhs);
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr CFixedPoint operator/(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return CFixedPoint(lhs) / CFixedPoint(rhs);
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr CFixedPoint operator%(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return CFixedPoint(lhs) % CFixedPoint(rhs);
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr bool operator==(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return CFixedPoint(lhs) == CFixedPoint(rhs);
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr bool operator!=(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr bool operator<(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return CFixedPoint(lhs) < CFixedPoint(rhs);
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr bool operator<=(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return !(rhs < lhs);
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr bool operator>(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return rhs < lhs;
+  }
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2,
+           typename CFixedPoint = common_fixed_point_t<fixed_point<Int1, FracBits1>, fixed_point<Int2, FracBits2>>>
+  constexpr bool operator>=(const fixed_point<Int1, FracBits1>& lhs, const fixed_point<Int2, FracBits2>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+
+  // fixed_point_traits
+
+  template<typename Rep>
+  struct fixed_point_traits {
+    using raw_type = Rep;
+    using scale = std::ratio<1>;
+    static constexpr raw_type raw(const Rep& v) { return v; }
+    static constexpr Rep from_raw(const raw_type& r) { return r; }
+  };
+
+  template<typename Int, unsigned FracBits>
+  struct fixed_point_traits<fixed_point<Int, FracBits>> {
+    using raw_type = Int;
+    using scale = std::ratio<(intmax_t(1) << FracBits)>;
+    static constexpr raw_type raw(const fixed_point<Int, FracBits>& v) { return v.raw(); }
+    static constexpr fixed_point<Int, FracBits> from_raw(const raw_type& r)
+    {
+      return fixed_point<Int, FracBits>::from_raw(r);
+    }
+  };
+
+  // treat_as_floating_point
+
+  template<typename Int, unsigned FracBits>
+  struct treat_as_floating_point<fixed_point<Int, FracBits>> : std::bool_constant<(FracBits > 0)> {
+  };
+
+  // quantity_values
+
+  template<typename Int, unsigned FracBits>
+  struct quantity_values<fixed_point<Int, FracBits>> {
+    static constexpr fixed_point<Int, FracBits> zero() { return fixed_point<Int, FracBits>(0); }
+    static constexpr fixed_point<Int, FracBits> max()
+    {
+      return fixed_point<Int, FracBits>::from_raw(std::numeric_limits<Int>::max());
+    }
+    static constexpr fixed_point<Int, FracBits> min()
+    {
+      return fixed_point<Int, FracBits>::from_raw(std::numeric_limits<Int>::lowest());
+    }
+  };
+
+  // quantity_cast
+
+  // The ratio conversion and the change of the fractional bits are folded into one compile-time ratio
+  // that is applied to the raw integers in a widened type.
+  template<typename To, typename CRatio, typename Int, unsigned FracBits>
+  struct quantity_cast_impl<To, CRatio, fixed_point<Int, FracBits>> {
+    template<typename Rep, typename Ratio>
+    static constexpr To cast(const quantity<Rep, Ratio>& q)
+    {
+      using to_rep = typename To::rep;
+      constexpr bool from_integral = std::is_integral_v<Rep> || is_fixed_point_v<Rep>;
+      constexpr bool to_integral = std::is_integral_v<to_rep> || is_fixed_point_v<to_rep>;
+      if constexpr (from_integral && to_integral) {
+        using from = fixed_point_traits<Rep>;
+        using to = fixed_point_traits<to_rep>;
+        using c_ratio = std::ratio_multiply<CRatio, std::ratio_divide<typename to::scale, typename from::scale>>;
+        using c_raw = std::common_type_t<typename from::raw_type, typename to::raw_type>;
+        using c_rep = std::conditional_t<std::is_void_v<widened_t<c_raw>>, c_raw, widened_t<c_raw>>;
+        auto raw = scale<c_ratio>(static_cast<c_rep>(from::raw(q.count())));
+        return To(to::from_raw(static_cast<typename to::raw_type>(raw)));
+      }
+      else {
+        return To(static_cast<to_rep>(scale<CRatio>(static_cast<double>(q.count()))));
+      }
+    }
+  };
+
+}  // namespace units
+
+namespace std {
+
+  // common_type
+
+  template<typename Int1, unsigned FracBits1, typename Int2, unsigned FracBits2>
+  struct common_type<units::fixed_point<Int1, FracBits1>, units::fixed_point<Int2, FracBits2>>
+      : units::common_fixed_point<units::fixed_point<Int1, FracBits1>, units::fixed_point<Int2, FracBits2>> {
+  };
+
+  template<typename Int, unsigned FracBits>
+  struct common_type<units::fixed_point<Int, FracBits>, float> {
+    using type = float;
+  };
+
+  template<typename Int, unsigned FracBits>
+  struct common_type<float, units::fixed_point<Int, FracBits>> {
+    using type = float;
+  };
+
+  template<typename Int, unsigned FracBits>
+  struct common_type<units::fixed_point<Int, FracBits>, double> {
+    using type = double;
+  };
+
+  template<typename Int, unsigned FracBits>
+  struct common_type<double, units::fixed_point<Int, FracBits>> {
+    using type = double;
+  };
+
+  template<typename Int, unsigned FracBits>
+  struct common_type<units::fixed_point<Int, FracBits>, long double> {
+    using type = long double;
+  };
+
+  template<typename Int, unsigned FracBits>
+  struct common_type<long double, units::fixed_point<Int, FracBits>> {
+    using type = long double;
+  };
+
+}  // namespace std
@@ -20,10 +20,151 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include "fixed_point.h"
 #include "quantity.h"
 
 namespace {
 
-  // put additional unit tests here
+  using namespace units;
+
+  template<typename Rep> using meters = quantity<Rep>;
+  template<typename Rep> using kilometers = quantity<Rep, std::kilo>;
+  template<typename Rep> using millimeters = quantity<Rep, std::milli>;
+
+  using fixed = fixed_point<int, 16>;
+  using fixed8 = fixed_point<int, 8>;
+
+  // fixed_point layout
+
+  static_assert(sizeof(fixed) == sizeof(int));
+  static_assert(std::is_trivially_copyable_v<fixed>);
+  static_assert(std::is_trivially_default_constructible_v<fixed>);
+  static_assert(std::is_same_v<widened_t<int>, long long> || std::is_same_v<widened_t<int>, long>);
+
+  // fixed_point construction and conversion
+
+  static_assert(fixed().raw() == 0);
+  static_assert(fixed(1).raw() == 65536);
+  static_assert(fixed(-2).raw() == -131072);
+  static_assert(fixed(0.5).raw() == 32768);
+  static_assert(fixed(short(-20000)).raw() == -20000 * 65536);
+  static_assert(fixed::from_raw(98304) == fixed(1.5));
+  static_assert(fixed(fixed8(2.5)) == fixed(2.5));
+  static_assert(fixed8(fixed(2.5)) == fixed8(2.5));
+  static_assert(std::is_convertible_v<fixed_point<short, 8>, fixed>);
+  static_assert(!std::is_convertible_v<fixed, fixed8>);
+  static_assert(!std::is_convertible_v<fixed8, fixed>);
+  static_assert(!std::is_convertible_v<fixed_point<unsigned, 16>, fixed>);
+  static_assert(static_cast<int>(fixed(2.75)) == 2);
+  static_assert(static_cast<double>(fixed(2.75)) == 2.75);
+  static_assert(static_cast<bool>(fixed(0.5)));
+  static_assert(static_cast<bool>(fixed(-0.5)));
+  static_assert(!fixed(0));
+  static_assert(std::is_same_v<std::common_type_t<fixed, fixed>, fixed>);
+  static_assert(std::is_same_v<std::common_type_t<fixed, fixed_point<short, 8>>, fixed>);
+  static_assert(std::is_same_v<std::common_type_t<fixed_point<short, 8>, fixed>, fixed>);
+  static_assert(
+      std::is_same_v<std::common_type_t<fixed_point<short, 8>, fixed_point<short, 4>>, fixed_point<std::int32_t, 8>>);
+  static_assert(std::is_same_v<std::common_type_t<fixed_point<short, 8>, fixed_point<unsigned short, 8>>,
+                               fixed_point<std::int32_t, 8>>);
+  static_assert(std::is_same_v<std::common_type_t<fixed, int>, fixed>);
+  static_assert(std::is_same_v<std::common_type_t<fixed, double>, double>);
+  static_assert(std::is_same_v<std::common_type_t<float, fixed>, float>);
+  static_assert(std::is_same_v<decltype(fixed(1.5) + 0.25), double>);
+  static_assert(fixed(1.5) + 0.00001 == 1.50001);
+  static_assert(fixed(1.5) == 1.5);
+  static_assert(0.25 < fixed(1.5));
+
+  // fixed_point arithmetic
+
+  static_assert(fixed(1.5) + fixed(2.25) == fixed(3.75));
+  static_assert(fixed(1.5) - fixed(2.25) == fixed(-0.75));
+  static_assert(fixed(1.5) * fixed(2.25) == fixed(3.375));
+  static_assert(fixed(3.375) / fixed(1.5) == fixed(2.25));
+  static_assert(fixed(5.5) % fixed(2) == fixed(1.5));
+  static_assert(fixed(1.5) * 3 == fixed(4.5));
+  static_assert(3 * fixed(1.5) == fixed(4.5));
+  static_assert(fixed(4.5) / 3 == fixed(1.5));
+  static_assert(fixed(-1.5) * 2u == fixed(-3));
+  static_assert(2u * fixed(-1.5) == fixed(-3));
+  static_assert(fixed(-1.5) / 2u == fixed(-0.75));
+  static_assert(fixed(-1.5) / std::size_t(2) == fixed(-0.75));
+  static_assert(fixed(200) * fixed(100) == fixed(20000));  // widened intermediate does not overflow
+  static_assert(fixed(10000) / fixed(0.5) == fixed(20000));
+  static_assert(-fixed(1.5) == fixed(-1.5));
+  static_assert([](fixed f) { return ++f; }(fixed(1.5)) == fixed(2.5));
+  static_assert([](fixed f) { return --f; }(fixed(1.5)) == fixed(0.5));
+  static_assert(fixed(1.5) < fixed(2));
+  static_assert(fixed(2) >= fixed(1.5));
+
+  // fixed_point as quantity rep
+
+  static_assert(treat_as_floating_point_v<fixed>);
+  static_assert(!treat_as_floating_point_v<fixed_point<int, 0>>);
+  static_assert(meters<fixed>(1.5).count() == fixed(1.5));
+  static_assert(meters<fixed>(meters<int>(2)).count() == fixed(2));
+  static_assert(meters<fixed>::zero().count() == fixed(0));
+  static_assert(meters<fixed>::max().count().raw() == std::numeric_limits<int>::max());
+  static_assert(meters<fixed>::min().count().raw() == std::numeric_limits<int>::lowest());
+  static_assert(meters<fixed>(1.5) + meters<fixed>(2.25) == meters<fixed>(3.75));
+  static_assert(meters<fixed>(1.5) * 2 == meters<fixed>(3));
+  static_assert(meters<fixed>(-1.5) * 2u == meters<fixed>(-3));
+  static_assert(meters<fixed>(-1.5) / 2u == meters<fixed>(-0.75));
+  static_assert(meters<fixed>(1.5) * fixed(0.5) == meters<fixed>(0.75));
+  static_assert(meters<fixed>(3) / meters<fixed>(2) == fixed(1.5));
+  static_assert(std::is_same_v<decltype(meters<fixed>(1.5) + meters<double>(0.00001)), meters<double>>);
+  static_assert(meters<fixed>(1.5) + meters<double>(0.00001) == meters<double>(1.50001));
+  static_assert(std::is_same_v<decltype(meters<fixed_point<short, 8>>(1) + meters<fixed_point<short, 4>>(1.5)),
+                               meters<fixed_point<std::int32_t, 8>>>);
+  static_assert(meters<fixed_point<short, 8>>(1) + meters<fixed_point<short, 4>>(1.5) ==
+                meters<fixed_point<int, 8>>(2.5));
+  static_assert(meters<fixed_point<short, 8>>(-1) == meters<fixed_point<unsigned short, 4>>(0) - meters<fixed>(1));
+  static_assert(meters<fixed_point<short, 8>>(1) < meters<fixed_point<short, 4>>(1.5));
+  static_assert(std::common_type_t<meters<fixed_point<short, 8>>, meters<fixed_point<short, 4>>>(
+                    meters<fixed_point<short, 4>>(1.5)) == meters<fixed_point<short, 8>>(1.5));
+
+  // fixed_point quantity_cast
+
+  static_assert(quantity_cast<meters<fixed>>(kilometers<fixed>(1.5)).count() == fixed(1500));
+  static_assert(quantity_cast<kilometers<fixed>>(meters<fixed>(1500)).count() == fixed(1.5));
+  static_assert(quantity_cast<meters<int>>(kilometers<fixed>(1.5)).count() == 1500);
+  static_assert(quantity_cast<kilometers<fixed>>(meters<int>(1500)).count() == fixed(1.5));
+  static_assert(quantity_cast<meters<int>>(meters<fixed>(2.75)).count() == 2);
+  static_assert(quantity_cast<meters<double>>(kilometers<fixed>(1.5)).count() == 1500.0);
+  static_assert(quantity_cast<kilometers<fixed>>(meters<double>(1500.0)).count() == fixed(1.5));
+
+  // 64-bit raw types need a 128-bit integer for the widened multiplication and division
+
+#if defined(__SIZEOF_INT128__)
+  using fixed64 = fixed_point<long long, 32>;
+
+  static_assert(std::is_convertible_v<fixed, fixed64>);
+  static_assert(!std::is_convertible_v<fixed64, fixed>);
+  static_assert(std::is_constructible_v<fixed, fixed64>);
+  static_assert(fixed64(fixed(-2.5)) == fixed64(-2.5));
+  static_assert(fixed64(-1.5) / 2u == fixed64(-0.75));
+  static_assert(fixed64(1000000) * fixed64(0.25) == fixed64(250000));
+  static_assert(quantity_cast<millimeters<fixed64>>(meters<fixed8>(1.5)).count() == fixed64(1500));
+
+  template<typename T, typename U, typename = void>
+  struct has_common_type : std::false_type {
+  };
+
+  template<typename T, typename U>
+  struct has_common_type<T, U, std::void_t<std::common_type_t<T, U>>> : std::true_type {
+  };
+
+  static_assert(std::is_same_v<std::common_type_t<fixed, fixed8>, fixed_point<std::int64_t, 16>>);
+  static_assert(std::is_same_v<std::common_type_t<fixed, fixed_point<unsigned, 16>>, fixed_point<std::int64_t, 16>>);
+  static_assert(std::is_same_v<std::common_type_t<fixed, fixed64>, fixed64>);
+  static_assert(!has_common_type<fixed64, fixed_point<unsigned long long, 62>>::value);
+  static_assert(fixed(-1) < fixed_point<unsigned, 16>(1));
+  static_assert(meters<fixed>(1) + meters<fixed8>(1) == meters<fixed_point<std::int64_t, 16>>(2));
+  static_assert(meters<fixed>(1) == meters<fixed8>(1));
+  static_assert(std::common_type_t<meters<fixed>, meters<fixed8>>(meters<fixed8>(1)) == meters<fixed>(1));
+  static_assert(quantity_cast<kilometers<fixed8>>(meters<fixed>(1500)).count() == fixed8(1.5));
+  static_assert(quantity_cast<meters<fixed_point<unsigned long long, 62>>>(millimeters<unsigned>(1500)).count() ==
+                fixed_point<unsigned long long, 62>(1.5));
+#endif
 
 }  // namespace